@@ -26,6 +26,7 @@ License
 ################################################################################
 
 from re import sub
+from struct import pack
 
 class thermophysicalTable() :
     """Base class for manipulate thermophysical table
@@ -62,6 +63,49 @@ class thermophysicalTable() :
                 f.write('( {} ({}))\n'.format(element[0], stringOut))
             f.write(')')
 
+    def writeBinary(self, fileName='', transpose=False) :
+        """ Write a thermophysical file in the binary format mapped by
+        OpenFOAM (fileFormat binary), see extrapolation2DFile.H
+
+        With transpose=True the table is stored with its axes swapped and
+        flagged as transposed, e.g. the h(p, T) table as h(T, p): OpenFOAM
+        then looks it up on the (T, p) grid of the other tables without
+        copying it. The rows must share the same values. """
+
+        nX = len(self.table)
+        nY = len(self.table[0][1])
+        xAxis = [float(element[0]) for element in self.table]
+        yAxis = [float(elem[0]) for elem in self.table[0][1]]
+        sharedY = all([float(elem[0]) for elem in element[1]] == yAxis
+                      for element in self.table)
+        values = [[float(elem[1]) for elem in element[1]]
+                  for element in self.table]
+
+        if transpose :
+            if not sharedY :
+                raise ValueError('cannot store ' + fileName + ' transposed:'
+                                 ' its rows do not share the same values')
+            nX, nY = nY, nX
+            xAxis, yAxis = yAxis, xAxis
+            values = [list(column) for column in zip(*values)]
+
+        with open(fileName, 'wb') as f :
+            # Header: tag, version, scalar size, number of components,
+            # nX, nY, flags (1: shared y axis, 2: transposed),
+            # x and y spacings (auto)
+            f.write(b'e2dTable')
+            f.write(pack('=8q', 2, 8, 1, nX, nY,
+                         int(sharedY) + 2*int(transpose), 0, 0))
+            f.write(pack('={}d'.format(nX), *xAxis))
+            if sharedY :
+                f.write(pack('={}d'.format(nY), *yAxis))
+            else :
+                for element in self.table :
+                    f.write(pack('={}d'.format(nY),
+                                 *[float(elem[0]) for elem in element[1]]))
+            for row in values :
+                f.write(pack('={}d'.format(nY), *row))
+
     def importation(self, fileName='', ext = '') :
         """ Import thermophysical data from a file.
         Only CSV is implemented yet """
@@ -87,3 +131,12 @@ thermo = thermophysicalTable()
 thermo.read('hTable_orig')
 thermo.transpose()
 thermo.write('hTable_transposed')
+
+# To convert the tables to the binary format, the h(p, T) table transposed so
+# that it is mapped on the (T, p) grid of the other tables:
+# thermo = thermophysicalTable()
+# thermo.read('densityTable')
+# thermo.writeBinary('densityTable.bin')
+# thermo = thermophysicalTable()
+# thermo.read('hTable')
+# thermo.writeBinary('hTable.bin', transpose=True)